@@ -1,7 +1,10 @@
+#define _POSIX_C_SOURCE 199309L // Necessário para clock_gettime
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
 #include <math.h>
+#include <stdint.h>
 
 #define MAX_VAL 100000
 #define MIN_SIZE 100000 // Tamanho mínimo do vetor
@@ -9,6 +12,9 @@
 #define SIZE_STEP 100000 // Incremento do tamanho do vetor
 #define NUM_BUSCAS 100 // Número de buscas aleatórias
 #define NUM_EXECUCOES 3 // Número de execuções do pior caso
+#define SKIP_MAX_NIVEL 20 // Altura máxima da skip list (log2 de MAX_SIZE)
+#define SKIP_SEMENTE 2463534242u // Semente fixa do gerador de níveis
+#define SKIP_BLOCO_POOL (1 << 20) // Bytes por bloco do pool de nós
 
 // Definição da estrutura de um nó da lista ligada
 typedef struct No {
@@ -36,7 +42,8 @@ void inserir_inicio(No **cabeca, unsigned int valor) {
 }
 
 // Função de busca sequencial em lista ligada
-int busca_sequencial_lista(No *cabeca, unsigned int chave, int *num_comparacoes) {
+// Cada avanço para o próximo ponteiro conta como um salto
+int busca_sequencial_lista(No *cabeca, unsigned int chave, int *num_comparacoes, int *num_saltos) {
     No *atual = cabeca;
     int indice = 0;
     while (atual != NULL) {
@@ -45,11 +52,285 @@ int busca_sequencial_lista(No *cabeca, unsigned int chave, int *num_comparacoes)
             return indice; // Retorna o índice do elemento encontrado
         }
         atual = atual->proximo;
+        (*num_saltos)++;
         indice++;
     }
     return -1; // Retorna -1 se o elemento não for encontrado
 }
 
+// Definição da estrutura de um nó da skip list
+// O vetor de ponteiros tem um elemento por nível do nó
+typedef struct NoSkip {
+    unsigned int valor;
+    int nivel;
+    struct NoSkip *proximo[];
+} NoSkip;
+
+// Bloco de memória do pool de nós da skip list
+typedef struct BlocoPool {
+    struct BlocoPool *proximo;
+    size_t usado;
+    unsigned char *dados;
+} BlocoPool;
+
+// Pool de nós: aloca em blocos grandes e reaproveita nós removidos por nível
+typedef struct PoolSkip {
+    BlocoPool *blocos;
+    NoSkip *livres[SKIP_MAX_NIVEL];
+    size_t bytes_em_uso; // Bytes dos nós em uso, incluindo a cabeça
+    size_t bytes_reservados; // Blocos alocados, incluindo cabeçalhos e sobras
+} PoolSkip;
+
+// Definição da skip list
+typedef struct ListaSkip {
+    NoSkip *cabeca;
+    int nivel;
+    unsigned int tamanho;
+    uint32_t estado; // Estado do gerador de níveis (xorshift32)
+    PoolSkip pool;
+} ListaSkip;
+
+// Função para calcular o tamanho em bytes de um nó com o nível dado
+size_t tamanho_no_skip(int nivel) {
+    return sizeof(NoSkip) + nivel * sizeof(NoSkip *);
+}
+
+// Função para alocar um nó do pool, reaproveitando nós removidos do mesmo nível
+NoSkip *alocar_no_skip(PoolSkip *pool, int nivel) {
+    size_t tamanho = tamanho_no_skip(nivel);
+    NoSkip *no = pool->livres[nivel - 1];
+    if (no != NULL) {
+        pool->livres[nivel - 1] = no->proximo[0];
+    } else {
+        if (pool->blocos == NULL || pool->blocos->usado + tamanho > SKIP_BLOCO_POOL) {
+            BlocoPool *bloco = (BlocoPool *)malloc(sizeof(BlocoPool));
+            if (bloco == NULL || (bloco->dados = (unsigned char *)malloc(SKIP_BLOCO_POOL)) == NULL) {
+                printf("Erro na alocação de memória.\n");
+                exit(1);
+            }
+            bloco->usado = 0;
+            pool->bytes_reservados += sizeof(BlocoPool) + SKIP_BLOCO_POOL;
+            bloco->proximo = pool->blocos;
+            pool->blocos = bloco;
+        }
+        no = (NoSkip *)(pool->blocos->dados + pool->blocos->usado);
+        pool->blocos->usado += tamanho;
+    }
+    pool->bytes_em_uso += tamanho;
+    no->nivel = nivel;
+    for (int i = 0; i < nivel; i++) {
+        no->proximo[i] = NULL;
+    }
+    return no;
+}
+
+// Função para devolver um nó ao pool
+void liberar_no_skip(PoolSkip *pool, NoSkip *no) {
+    no->proximo[0] = pool->livres[no->nivel - 1];
+    pool->livres[no->nivel - 1] = no;
+    pool->bytes_em_uso -= tamanho_no_skip(no->nivel);
+}
+
+// Função para criar uma skip list vazia
+// A semente fixa só fixa a sequência de níveis sorteados; como o vetor é embaralhado
+// com srand(time(NULL)), o nível de cada chave ainda muda entre execuções
+void iniciar_skip(ListaSkip *lista) {
+    lista->pool.blocos = NULL;
+    lista->pool.bytes_em_uso = 0;
+    lista->pool.bytes_reservados = 0;
+    for (int i = 0; i < SKIP_MAX_NIVEL; i++) {
+        lista->pool.livres[i] = NULL;
+    }
+    lista->cabeca = alocar_no_skip(&lista->pool, SKIP_MAX_NIVEL);
+    lista->nivel = 1;
+    lista->tamanho = 0;
+    lista->estado = SKIP_SEMENTE;
+}
+
+// Função para sortear o nível de um novo nó (probabilidade 1/2 por nível)
+int nivel_aleatorio_skip(ListaSkip *lista) {
+    uint32_t x = lista->estado;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    lista->estado = x;
+
+    int nivel = 1;
+    while (nivel < SKIP_MAX_NIVEL && (x & 1)) {
+        nivel++;
+        x >>= 1;
+    }
+    return nivel;
+}
+
+// Função de busca na skip list
+// Cada valor lido conta como uma comparação; só o avanço de atual conta como salto,
+// então as sondagens que param em um nível não contam como salto
+NoSkip *busca_skip(ListaSkip *lista, unsigned int chave, int *num_comparacoes, int *num_saltos) {
+    NoSkip *atual = lista->cabeca;
+    for (int i = lista->nivel - 1; i >= 0; i--) {
+        while (atual->proximo[i] != NULL) {
+            (*num_comparacoes)++;
+            if (atual->proximo[i]->valor >= chave) {
+                break;
+            }
+            atual = atual->proximo[i];
+            (*num_saltos)++;
+        }
+    }
+    // O candidato já foi lido no nível 0; resta apenas o teste de igualdade
+    atual = atual->proximo[0];
+    (*num_saltos)++;
+    if (atual != NULL) {
+        (*num_comparacoes)++;
+        if (atual->valor == chave) {
+            return atual;
+        }
+    }
+    return NULL;
+}
+
+// Função para localizar o último nó menor que a chave em cada nível
+NoSkip *predecessores_skip(ListaSkip *lista, unsigned int chave, NoSkip **atualizar) {
+    NoSkip *atual = lista->cabeca;
+    for (int i = lista->nivel - 1; i >= 0; i--) {
+        while (atual->proximo[i] != NULL && atual->proximo[i]->valor < chave) {
+            atual = atual->proximo[i];
+        }
+        atualizar[i] = atual;
+    }
+    return atual->proximo[0];
+}
+
+// Função para inserir um valor na skip list mantendo a ordem
+// Retorna 0 se o valor já estiver presente
+int inserir_skip(ListaSkip *lista, unsigned int valor) {
+    NoSkip *atualizar[SKIP_MAX_NIVEL];
+    NoSkip *candidato = predecessores_skip(lista, valor, atualizar);
+    if (candidato != NULL && candidato->valor == valor) {
+        return 0;
+    }
+
+    int nivel = nivel_aleatorio_skip(lista);
+    if (nivel > lista->nivel) {
+        for (int i = lista->nivel; i < nivel; i++) {
+            atualizar[i] = lista->cabeca;
+        }
+        lista->nivel = nivel;
+    }
+
+    NoSkip *novo = alocar_no_skip(&lista->pool, nivel);
+    novo->valor = valor;
+    for (int i = 0; i < nivel; i++) {
+        novo->proximo[i] = atualizar[i]->proximo[i];
+        atualizar[i]->proximo[i] = novo;
+    }
+    lista->tamanho++;
+    return 1;
+}
+
+// Função para remover um valor da skip list
+// Retorna 0 se o valor não estiver presente
+int remover_skip(ListaSkip *lista, unsigned int valor) {
+    NoSkip *atualizar[SKIP_MAX_NIVEL];
+    NoSkip *alvo = predecessores_skip(lista, valor, atualizar);
+    if (alvo == NULL || alvo->valor != valor) {
+        return 0;
+    }
+
+    for (int i = 0; i < alvo->nivel; i++) {
+        atualizar[i]->proximo[i] = alvo->proximo[i];
+    }
+    while (lista->nivel > 1 && lista->cabeca->proximo[lista->nivel - 1] == NULL) {
+        lista->nivel--;
+    }
+    liberar_no_skip(&lista->pool, alvo);
+    lista->tamanho--;
+    return 1;
+}
+
+// Função para calcular a memória ocupada pelos nós da skip list (incluindo a cabeça)
+// Mesma medida usada para a lista ligada: só os bytes dos nós, sem o custo do alocador
+double memoria_skip(ListaSkip *lista) {
+    return (double)lista->pool.bytes_em_uso;
+}
+
+// Função para calcular a memória reservada pelo pool (blocos, cabeçalhos e sobras)
+double memoria_reservada_skip(ListaSkip *lista) {
+    return (double)lista->pool.bytes_reservados;
+}
+
+// Função para verificar a estrutura da skip list
+// Confere a ordem estrita em cada nível, que cada nó do nível i também está no
+// nível i-1, que cada nó está encadeado em todos os níveis abaixo do seu e que
+// o nível 0 tem exatamente lista->tamanho nós
+int verificar_skip(ListaSkip *lista) {
+    unsigned int esperados[SKIP_MAX_NIVEL] = {0}; // Nós com nivel > i, contados no nível 0
+
+    for (int i = lista->nivel; i < SKIP_MAX_NIVEL; i++) {
+        if (lista->cabeca->proximo[i] != NULL) {
+            return 0;
+        }
+    }
+
+    unsigned int contagem = 0;
+    for (NoSkip *atual = lista->cabeca->proximo[0]; atual != NULL; atual = atual->proximo[0]) {
+        if (atual->nivel < 1 || atual->nivel > lista->nivel ||
+            (atual->proximo[0] != NULL && atual->proximo[0]->valor <= atual->valor)) {
+            return 0;
+        }
+        for (int i = 0; i < atual->nivel; i++) {
+            esperados[i]++;
+        }
+        contagem++;
+    }
+    if (contagem != lista->tamanho) {
+        return 0;
+    }
+
+    for (int i = 1; i < lista->nivel; i++) {
+        unsigned int encadeados = 0;
+        NoSkip *abaixo = lista->cabeca->proximo[i - 1];
+        for (NoSkip *atual = lista->cabeca->proximo[i]; atual != NULL; atual = atual->proximo[i]) {
+            encadeados++;
+            if (atual->nivel <= i || (atual->proximo[i] != NULL && atual->proximo[i]->valor <= atual->valor)) {
+                return 0;
+            }
+            // O nível i-1 é ordenado, então basta avançar até encontrar o nó
+            while (abaixo != NULL && abaixo != atual) {
+                abaixo = abaixo->proximo[i - 1];
+            }
+            if (abaixo == NULL) {
+                return 0;
+            }
+        }
+        if (encadeados != esperados[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Função para liberar todos os blocos do pool da skip list
+void liberar_skip(ListaSkip *lista) {
+    BlocoPool *bloco = lista->pool.blocos;
+    while (bloco != NULL) {
+        BlocoPool *temp = bloco;
+        bloco = bloco->proximo;
+        free(temp->dados);
+        free(temp);
+    }
+    lista->pool.blocos = NULL;
+    lista->cabeca = NULL;
+}
+
+// Função para ler o relógio monotônico em segundos
+double tempo_atual(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
 // Função para gerar números aleatórios dentro de um intervalo
 unsigned int rand_range(unsigned int max) {
     return rand() % (max + 1);
@@ -73,6 +354,25 @@ double calcular_desvio_padrao(double *valores, int n, double media) {
     return sqrt(soma / n);
 }
 
+// Função para imprimir média e desvio padrão de uma série de buscas
+void imprimir_estatisticas(const char *rotulo, unsigned int tamanho_lista, double *comparacoes, double *saltos, double *tempos, double *memorias, int n) {
+    double media_comparacoes = calcular_media(comparacoes, n);
+    double media_saltos = calcular_media(saltos, n);
+    double media_tempo = calcular_media(tempos, n);
+    double media_memoria = calcular_media(memorias, n);
+
+    printf("%s - tamanho do vetor: %u\n", rotulo, tamanho_lista);
+    printf("Média de comparações: %f\n", media_comparacoes);
+    printf("Desvio padrão de comparações: %f\n", calcular_desvio_padrao(comparacoes, n, media_comparacoes));
+    printf("Média de saltos de ponteiro: %f\n", media_saltos);
+    printf("Desvio padrão de saltos de ponteiro: %f\n", calcular_desvio_padrao(saltos, n, media_saltos));
+    printf("Média de tempo de execução: %e\n", media_tempo);
+    printf("Desvio padrão de tempo de execução: %e\n", calcular_desvio_padrao(tempos, n, media_tempo));
+    printf("Média de consumo de memória: %f\n", media_memoria);
+    printf("Desvio padrão de consumo de memória: %f\n", calcular_desvio_padrao(memorias, n, media_memoria));
+    printf("Memória por elemento: %f\n", media_memoria / tamanho_lista);
+}
+
 int main() {
     // Inicializa o gerador de números aleatórios
     srand(time(NULL));
@@ -85,7 +385,7 @@ int main() {
     }
 
     // Escreve o cabeçalho do arquivo CSV
-    fprintf(arquivo, "Tamanho Lista,Busca,Chave,Índice Encontrado,Comparações,Tempo Execução,Consumo Memória\n");
+    fprintf(arquivo, "Estrutura,Tamanho Lista,Busca,Chave,Índice Encontrado,Valor Encontrado,Comparações,Saltos Ponteiro,Tempo Execução,Consumo Memória,Memória por Elemento,Memória Reservada\n");
 
     // Loop para testar diferentes tamanhos de lista
     for (unsigned int tamanho_lista = MIN_SIZE; tamanho_lista <= MAX_SIZE; tamanho_lista += SIZE_STEP) {
@@ -114,99 +414,146 @@ int main() {
             inserir_inicio(&cabeca, vetor[i]);
         }
 
+        // Criação da skip list a partir do mesmo vetor embaralhado
+        ListaSkip skip;
+        iniciar_skip(&skip);
+        for (unsigned int i = 0; i < tamanho_lista; i++) {
+            inserir_skip(&skip, vetor[i]);
+        }
+
+        double memoria_lista = (double)tamanho_lista * sizeof(No);
+        double memoria_skip_list = memoria_skip(&skip);
+        double memoria_reservada = memoria_reservada_skip(&skip);
+
         // Arrays para armazenar resultados
-        double tempos_execucao[NUM_BUSCAS];
-        double num_comparacoes[NUM_BUSCAS];
-        double consumos_memoria[NUM_BUSCAS];
+        double tempos_execucao[NUM_BUSCAS], tempos_execucao_skip[NUM_BUSCAS];
+        double num_comparacoes[NUM_BUSCAS], num_comparacoes_skip[NUM_BUSCAS];
+        double num_saltos[NUM_BUSCAS], num_saltos_skip[NUM_BUSCAS];
+        double consumos_memoria[NUM_BUSCAS], consumos_memoria_skip[NUM_BUSCAS];
 
-        // Realiza as buscas na lista ligada e salva os resultados no arquivo CSV
+        // Realiza as buscas nas duas estruturas com as mesmas chaves e salva os resultados no arquivo CSV
         for (int i = 0; i < NUM_BUSCAS; i++) {
             unsigned int chave = rand_range(MAX_VAL);
-            clock_t inicio = clock();
+            double inicio = tempo_atual();
             int comparacoes = 0;
-            int indice_encontrado = busca_sequencial_lista(cabeca, chave, &comparacoes);
-            clock_t fim = clock();
-            double tempo_execucao = ((double) (fim - inicio)) / CLOCKS_PER_SEC;
+            int saltos = 0;
+            int indice_encontrado = busca_sequencial_lista(cabeca, chave, &comparacoes, &saltos);
+            double fim = tempo_atual();
+            double tempo_execucao = fim - inicio;
 
             // Salva os resultados no array
             num_comparacoes[i] = comparacoes;
+            num_saltos[i] = saltos;
             tempos_execucao[i] = tempo_execucao;
-            consumos_memoria[i] = tamanho_lista * sizeof(No);
+            consumos_memoria[i] = memoria_lista;
 
             // Escreve os resultados da busca no arquivo CSV
-            fprintf(arquivo, "%u,%d,%u,%d,%d,%f,%f\n", tamanho_lista, i + 1, chave, indice_encontrado, comparacoes, tempo_execucao, consumos_memoria[i]);
-        }
+            fprintf(arquivo, "Lista Ligada,%u,%d,%u,%d,%d,%d,%d,%e,%f,%f,\n", tamanho_lista, i + 1, chave, indice_encontrado, indice_encontrado >= 0 ? (int)chave : -1, comparacoes, saltos, tempo_execucao, consumos_memoria[i], consumos_memoria[i] / tamanho_lista);
+
+            inicio = tempo_atual();
+            comparacoes = 0;
+            saltos = 0;
+            NoSkip *encontrado = busca_skip(&skip, chave, &comparacoes, &saltos);
+            fim = tempo_atual();
+            tempo_execucao = fim - inicio;
+
+            // A skip list não guarda a posição no vetor embaralhado; registra só o valor encontrado
+            int valor_encontrado = encontrado != NULL ? (int)encontrado->valor : -1;
 
-        // Calcula a média e o desvio padrão
-        double media_comparacoes = calcular_media(num_comparacoes, NUM_BUSCAS);
-        double desvio_padrao_comparacoes = calcular_desvio_padrao(num_comparacoes, NUM_BUSCAS, media_comparacoes);
-        double media_tempo_execucao = calcular_media(tempos_execucao, NUM_BUSCAS);
-        double desvio_padrao_tempo_execucao = calcular_desvio_padrao(tempos_execucao, NUM_BUSCAS, media_tempo_execucao);
-        double media_consumo_memoria = calcular_media(consumos_memoria, NUM_BUSCAS);
-        double desvio_padrao_consumo_memoria = calcular_desvio_padrao(consumos_memoria, NUM_BUSCAS, media_consumo_memoria);
+            num_comparacoes_skip[i] = comparacoes;
+            num_saltos_skip[i] = saltos;
+            tempos_execucao_skip[i] = tempo_execucao;
+            consumos_memoria_skip[i] = memoria_skip_list;
+
+            fprintf(arquivo, "Skip List,%u,%d,%u,,%d,%d,%d,%e,%f,%f,%f\n", tamanho_lista, i + 1, chave, valor_encontrado, comparacoes, saltos, tempo_execucao, consumos_memoria_skip[i], consumos_memoria_skip[i] / tamanho_lista, memoria_reservada);
+        }
 
         // Imprime a média e o desvio padrão
-        printf("Tamanho do vetor: %u\n", tamanho_lista);
-        printf("Média de comparações: %f\n", media_comparacoes);
-        printf("Desvio padrão de comparações: %f\n", desvio_padrao_comparacoes);
-        printf("Média de tempo de execução: %f\n", media_tempo_execucao);
-        printf("Desvio padrão de tempo de execução: %f\n", desvio_padrao_tempo_execucao);
-        printf("Média de consumo de memória: %f\n", media_consumo_memoria);
-        printf("Desvio padrão de consumo de memória: %f\n", desvio_padrao_consumo_memoria);
+        imprimir_estatisticas("Lista Ligada", tamanho_lista, num_comparacoes, num_saltos, tempos_execucao, consumos_memoria, NUM_BUSCAS);
+        imprimir_estatisticas("Skip List", tamanho_lista, num_comparacoes_skip, num_saltos_skip, tempos_execucao_skip, consumos_memoria_skip, NUM_BUSCAS);
+        printf("Memória reservada pelo pool: %f\n", memoria_reservada);
 
         // Arrays para armazenar resultados do pior caso
-        double tempos_execucao_pior[NUM_EXECUCOES];
-        double num_comparacoes_pior[NUM_EXECUCOES];
-        double consumos_memoria_pior[NUM_EXECUCOES];
+        double tempos_execucao_pior[NUM_EXECUCOES], tempos_execucao_pior_skip[NUM_EXECUCOES];
+        double num_comparacoes_pior[NUM_EXECUCOES], num_comparacoes_pior_skip[NUM_EXECUCOES];
+        double num_saltos_pior[NUM_EXECUCOES], num_saltos_pior_skip[NUM_EXECUCOES];
+        double consumos_memoria_pior[NUM_EXECUCOES], consumos_memoria_pior_skip[NUM_EXECUCOES];
 
-        // Realiza as buscas do pior caso (chave não presente) na lista ligada
+        // Realiza as buscas do pior caso (chave não presente) nas duas estruturas
         for (int i = 0; i < NUM_EXECUCOES; i++) {
             unsigned int chave = tamanho_lista + 1; // Chave não presente
-            clock_t inicio = clock();
+            double inicio = tempo_atual();
             int comparacoes = 0;
-            int indice_encontrado = busca_sequencial_lista(cabeca, chave, &comparacoes);
-            clock_t fim = clock();
-            double tempo_execucao = ((double) (fim - inicio)) / CLOCKS_PER_SEC;
+            int saltos = 0;
+            int indice_encontrado = busca_sequencial_lista(cabeca, chave, &comparacoes, &saltos);
+            double fim = tempo_atual();
+            double tempo_execucao = fim - inicio;
 
             // Salva os resultados no array
             num_comparacoes_pior[i] = comparacoes;
+            num_saltos_pior[i] = saltos;
             tempos_execucao_pior[i] = tempo_execucao;
-            consumos_memoria_pior[i] = tamanho_lista * sizeof(No);
+            consumos_memoria_pior[i] = memoria_lista;
 
             // Escreve os resultados da busca no arquivo CSV
-            fprintf(arquivo, "%u,Pior Caso %d,%u,%d,%d,%f,%f\n", tamanho_lista, i + 1, chave, indice_encontrado, comparacoes, tempo_execucao, consumos_memoria_pior[i]);
+            fprintf(arquivo, "Lista Ligada,%u,Pior Caso %d,%u,%d,%d,%d,%d,%e,%f,%f,\n", tamanho_lista, i + 1, chave, indice_encontrado, indice_encontrado >= 0 ? (int)chave : -1, comparacoes, saltos, tempo_execucao, consumos_memoria_pior[i], consumos_memoria_pior[i] / tamanho_lista);
+
+            inicio = tempo_atual();
+            comparacoes = 0;
+            saltos = 0;
+            NoSkip *encontrado = busca_skip(&skip, chave, &comparacoes, &saltos);
+            fim = tempo_atual();
+            tempo_execucao = fim - inicio;
+            int valor_encontrado = encontrado != NULL ? (int)encontrado->valor : -1;
+
+            num_comparacoes_pior_skip[i] = comparacoes;
+            num_saltos_pior_skip[i] = saltos;
+            tempos_execucao_pior_skip[i] = tempo_execucao;
+            consumos_memoria_pior_skip[i] = memoria_skip_list;
+
+            fprintf(arquivo, "Skip List,%u,Pior Caso %d,%u,,%d,%d,%d,%e,%f,%f,%f\n", tamanho_lista, i + 1, chave, valor_encontrado, comparacoes, saltos, tempo_execucao, consumos_memoria_pior_skip[i], consumos_memoria_pior_skip[i] / tamanho_lista, memoria_reservada);
         }
 
-        // Calcula a média e o desvio padrão para o pior caso
-      double media_comparacoes_pior = calcular_media(num_comparacoes_pior, NUM_EXECUCOES);
-      double desvio_padrao_comparacoes_pior = calcular_desvio_padrao(num_comparacoes_pior, NUM_EXECUCOES, media_comparacoes_pior);
-      double media_tempo_execucao_pior = calcular_media(tempos_execucao_pior, NUM_EXECUCOES);
-double desvio_padrao_tempo_execucao_pior = calcular_desvio_padrao(tempos_execucao_pior, NUM_EXECUCOES, media_tempo_execucao_pior);
-double media_consumo_memoria_pior = calcular_media(consumos_memoria_pior, NUM_EXECUCOES);
-double desvio_padrao_consumo_memoria_pior = calcular_desvio_padrao(consumos_memoria_pior, NUM_EXECUCOES, media_consumo_memoria_pior);
+        // Imprime a média e o desvio padrão para o pior caso
+        imprimir_estatisticas("Lista Ligada (pior caso)", tamanho_lista, num_comparacoes_pior, num_saltos_pior, tempos_execucao_pior, consumos_memoria_pior, NUM_EXECUCOES);
+        imprimir_estatisticas("Skip List (pior caso)", tamanho_lista, num_comparacoes_pior_skip, num_saltos_pior_skip, tempos_execucao_pior_skip, consumos_memoria_pior_skip, NUM_EXECUCOES);
 
-// Imprime a média e o desvio padrão para o pior caso
-printf("Pior caso para o tamanho do vetor: %u\n", tamanho_lista);
-printf("Média de comparações (pior caso): %f\n", media_comparacoes_pior);
-printf("Desvio padrão de comparações (pior caso): %f\n", desvio_padrao_comparacoes_pior);
-printf("Média de tempo de execução (pior caso): %f\n", media_tempo_execucao_pior);
-printf("Desvio padrão de tempo de execução (pior caso): %f\n", desvio_padrao_tempo_execucao_pior);
-printf("Média de consumo de memória (pior caso): %f\n", media_consumo_memoria_pior);
-printf("Desvio padrão de consumo de memória (pior caso): %f\n", desvio_padrao_consumo_memoria_pior);
+        // Remove e reinsere chaves aleatórias na skip list e depois verifica a estrutura inteira
+        int erro = 0;
+        for (int i = 0; i < NUM_BUSCAS && !erro; i++) {
+            unsigned int chave = rand_range(tamanho_lista - 1);
+            int comparacoes = 0;
+            int saltos = 0;
+            if (!remover_skip(&skip, chave) || busca_skip(&skip, chave, &comparacoes, &saltos) != NULL ||
+                !inserir_skip(&skip, chave) || busca_skip(&skip, chave, &comparacoes, &saltos) == NULL) {
+                printf("Erro na remoção/inserção da skip list (chave %u).\n", chave);
+                erro = 1;
+            }
+        }
+        if (!erro && (skip.tamanho != tamanho_lista || !verificar_skip(&skip))) {
+            printf("Erro na estrutura da skip list (tamanho %u).\n", tamanho_lista);
+            erro = 1;
+        }
 
-// Libera a memória alocada para o vetor e a lista ligada
-free(vetor);
-while (cabeca != NULL) {
-    No *temp = cabeca;
-    cabeca = cabeca->proximo;
-    free(temp);
-}
-}
+        // Libera a memória alocada para o vetor, a lista ligada e a skip list
+        free(vetor);
+        while (cabeca != NULL) {
+            No *temp = cabeca;
+            cabeca = cabeca->proximo;
+            free(temp);
+        }
+        liberar_skip(&skip);
+
+        if (erro) {
+            fclose(arquivo);
+            return 1;
+        }
+    }
 
-// Fecha o arquivo
-fclose(arquivo);
+    // Fecha o arquivo
+    fclose(arquivo);
 
-printf("Os resultados das buscas foram salvos em 'resultados_busca.csv'.\n");
+    printf("Os resultados das buscas foram salvos em 'resultados_busca.csv'.\n");
 
-return 0;
+    return 0;
 }